@@ -11,6 +11,9 @@
 #include <iostream>
 #include <chrono>
 #include <thread>
+#include <array>
+#include <limits>
+#include <cstdint>
 
 // Constants
 const std::vector<char> DIRECTIONS = {'E', 'S', 'W', 'N'};
@@ -20,17 +23,26 @@ const std::map<char, std::pair<int, int>> DIRECTION_OFFSETS = {
 const std::string MAZE_CONFIG_FILE = "maze_config.txt";
 const float CELL_SIZE = 40.0f; // Pixels per cell for visualization
 const float AGENT_SIZE = 20.0f; // Agent size in pixels
+const double TERRAIN_TILE_CHANCE = 0.2; // Fraction of cells painted a non-black floor colour
+const int FORBIDDEN_COST = -1; // Cost value marking a tile the robot must never enter
+
+// Floor tile classes, matching getFloorColor() in Arduino/all3.ino
+enum Terrain { BLACK, RED, GREEN, YELLOW, BLUE, TERRAIN_COUNT };
+const std::array<std::string, TERRAIN_COUNT> TERRAIN_NAMES = {"black", "red", "green", "yellow", "blue"};
 
 // Configuration struct
 struct Config {
     int rows, cols;
     std::pair<int, int> start, end;
+    std::array<int, TERRAIN_COUNT> terrainCosts = {1, 10, 2, 3, 5}; // Cost of entering each tile class
+    double loopChance = 0.1; // Fraction of interior walls knocked out after generation so routes can differ
 };
 
 // Maze cell structure
 struct Cell {
     bool walls[4] = {true, true, true, true}; // E, S, W, N
     bool visited = false;
+    Terrain terrain = BLACK;
 };
 
 // Parse coordinate from config string
@@ -85,6 +97,33 @@ Config extractVariables(const std::string& filename) {
     validateCoord(config.start, "Start location");
     validateCoord(config.end, "End location");
 
+    // Terrain costs are optional; missing keys keep their defaults
+    for (int t = 0; t < TERRAIN_COUNT; ++t) {
+        std::regex costRegex(TERRAIN_NAMES[t] + "_cost\\s*=\\s*(-?\\d+)");
+        if (std::regex_search(content, match, costRegex)) {
+            int cost = std::stoi(match[1]);
+            if (cost < 1 && cost != FORBIDDEN_COST) {
+                throw std::runtime_error("'" + TERRAIN_NAMES[t] + "_cost' must be positive, or " +
+                                         std::to_string(FORBIDDEN_COST) + " for forbidden tiles.");
+            }
+            // assignTerrain() always leaves start and end on black floor, so forbidding black leaves no route
+            if (t == BLACK && cost == FORBIDDEN_COST) {
+                throw std::runtime_error("'black_cost' cannot be " + std::to_string(FORBIDDEN_COST) +
+                                         ": start and end tiles are always black floor.");
+            }
+            config.terrainCosts[t] = cost;
+        }
+    }
+
+    // Loop chance is optional; without extra openings the maze has exactly one route
+    std::regex loopRegex("loop_chance\\s*=\\s*(-?\\d*\\.?\\d+)");
+    if (std::regex_search(content, match, loopRegex)) {
+        config.loopChance = std::stod(match[1]);
+        if (config.loopChance < 0.0 || config.loopChance > 1.0) {
+            throw std::runtime_error("'loop_chance' must be between 0 and 1.");
+        }
+    }
+
     // Convert to 0-based indexing
     config.start = {config.start.first - 1, config.start.second - 1};
     config.end = {config.end.first - 1, config.end.second - 1};
@@ -102,7 +141,7 @@ void generateMaze(std::vector<std::vector<Cell>>& maze, int rows, int cols, std:
         stack.pop();
 
         // Get unvisited neighbors
-        std::vector<std::pair<int, char>> neighbors;
+        std::vector<std::pair<std::pair<int, int>, char>> neighbors;
         for (char dir : DIRECTIONS) {
             auto [dr, dc] = DIRECTION_OFFSETS.at(dir);
             int nr = r + dr, nc = c + dc;
@@ -136,6 +175,90 @@ void generateMaze(std::vector<std::vector<Cell>>& maze, int rows, int cols, std:
     }
 }
 
+// Knock out extra interior walls so the perfect maze gains loops and alternative routes
+void openExtraWalls(std::vector<std::vector<Cell>>& maze, int rows, int cols, double loopChance, std::mt19937& rng) {
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            // Only look East and South so each shared wall is considered once
+            if (c + 1 < cols && maze[r][c].walls[0] && chance(rng) < loopChance) {
+                maze[r][c].walls[0] = false;
+                maze[r][c + 1].walls[2] = false;
+            }
+            if (r + 1 < rows && maze[r][c].walls[1] && chance(rng) < loopChance) {
+                maze[r][c].walls[1] = false;
+                maze[r + 1][c].walls[3] = false;
+            }
+        }
+    }
+}
+
+// Paint random floor colours onto the maze; start and end stay plain black floor
+void assignTerrain(std::vector<std::vector<Cell>>& maze, int rows, int cols, std::pair<int, int> start,
+                   std::pair<int, int> end, std::mt19937& rng) {
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    std::uniform_int_distribution<int> colour(RED, TERRAIN_COUNT - 1);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            std::pair<int, int> pos = {r, c};
+            if (pos == start || pos == end || chance(rng) >= TERRAIN_TILE_CHANCE) {
+                maze[r][c].terrain = BLACK;
+            } else {
+                maze[r][c].terrain = static_cast<Terrain>(colour(rng));
+            }
+        }
+    }
+}
+
+// Number of significant bits in x (0 for x == 0)
+inline int bitWidth(std::uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return x == 0 ? 0 : 64 - __builtin_clzll(x);
+#else
+    int bits = 0;
+    while (x) {
+        ++bits;
+        x >>= 1;
+    }
+    return bits;
+#endif
+}
+
+// Monotone radix heap: popped keys never decrease, which Dijkstra guarantees for non-negative costs.
+// Entries are bucketed by the highest bit in which they differ from the last popped key, so each
+// entry is redistributed at most once per bit and both push and pop are amortised O(log C).
+class RadixHeap {
+public:
+    bool empty() const { return count == 0; }
+
+    void push(std::uint64_t key, int value) {
+        buckets[bitWidth(key ^ lastKey)].emplace_back(key, value);
+        ++count;
+    }
+
+    std::pair<std::uint64_t, int> pop() {
+        if (buckets[0].empty()) {
+            size_t i = 1;
+            while (buckets[i].empty()) ++i;
+
+            // The smallest key in the first non-empty bucket becomes the new reference point
+            lastKey = buckets[i][0].first;
+            for (const auto& entry : buckets[i]) lastKey = std::min(lastKey, entry.first);
+            for (const auto& entry : buckets[i]) buckets[bitWidth(entry.first ^ lastKey)].push_back(entry);
+            buckets[i].clear();
+        }
+        auto top = buckets[0].back();
+        buckets[0].pop_back();
+        --count;
+        return top;
+    }
+
+private:
+    std::array<std::vector<std::pair<std::uint64_t, int>>, 65> buckets;
+    std::uint64_t lastKey = 0;
+    size_t count = 0;
+};
+
 // DFS for full exploration
 std::vector<std::pair<int, int>> exploreAllReachableDFS(const std::vector<std::vector<Cell>>& maze,
                                                        std::pair<int, int> start,
@@ -239,6 +362,70 @@ std::map<std::pair<int, int>, std::pair<int, int>> findShortestPathBFS(const std
     return pathDict;
 }
 
+// Dijkstra for cheapest path over weighted floor tiles
+std::map<std::pair<int, int>, std::pair<int, int>> findCheapestPathDijkstra(const std::vector<std::vector<Cell>>& maze,
+                                                                           std::pair<int, int> start,
+                                                                           std::pair<int, int> end,
+                                                                           const std::array<int, TERRAIN_COUNT>& costs) {
+    std::cout << "\n--- Finding Cheapest Path from (" << start.first + 1 << "," << start.second + 1 << ") to ("
+              << end.first + 1 << "," << end.second + 1 << ") (Dijkstra, radix heap) ---\n";
+    const int rows = maze.size();
+    const int cols = maze[0].size();
+    const std::uint64_t UNREACHED = std::numeric_limits<std::uint64_t>::max();
+    // Offsets in E, S, W, N order, matching Cell::walls (avoids map lookups in the hot loop)
+    const int rowStep[4] = {0, 1, 0, -1};
+    const int colStep[4] = {1, 0, -1, 0};
+
+    // Flat row-major arrays keep the per-cell bookkeeping as cheap as plain BFS
+    std::vector<std::uint64_t> dist(rows * cols, UNREACHED);
+    std::vector<int> parent(rows * cols, -1);
+    const int source = start.first * cols + start.second;
+    const int target = end.first * cols + end.second;
+    RadixHeap heap;
+    bool pathFound = false;
+
+    dist[source] = 0;
+    heap.push(0, source);
+
+    while (!heap.empty()) {
+        auto [d, current] = heap.pop();
+        if (d != dist[current]) continue; // Stale entry superseded by a cheaper one
+        if (current == target) {
+            pathFound = true;
+            break;
+        }
+
+        int r = current / cols, c = current % cols;
+        for (int i = 0; i < 4; ++i) {
+            if (maze[r][c].walls[i]) continue;
+            int nr = r + rowStep[i], nc = c + colStep[i];
+            int cost = costs[maze[nr][nc].terrain];
+            if (cost == FORBIDDEN_COST) continue;
+            int next = nr * cols + nc;
+            std::uint64_t nextDist = d + cost;
+            if (nextDist < dist[next]) {
+                dist[next] = nextDist;
+                parent[next] = current;
+                heap.push(nextDist, next);
+            }
+        }
+    }
+
+    std::map<std::pair<int, int>, std::pair<int, int>> pathDict;
+    if (pathFound) {
+        std::cout << "Cheapest path found with total cost " << dist[target] << ". Reconstructing path dictionary...\n";
+        for (int curr = target; curr != source; curr = parent[curr]) {
+            int prev = parent[curr];
+            pathDict[{prev / cols, prev % cols}] = {curr / cols, curr % cols};
+        }
+        std::cout << "Cheapest path dictionary created with " << pathDict.size() << " segments.\n";
+    } else {
+        std::cout << "Error: No path avoiding forbidden tiles from (" << start.first + 1 << "," << start.second + 1
+                  << ") to (" << end.first + 1 << "," << end.second + 1 << ").\n";
+    }
+    return pathDict;
+}
+
 // Main function
 int main() {
     try {
@@ -255,6 +442,8 @@ int main() {
         std::mt19937 rng(rd());
         std::cout << "Debug: Generating maze...\n";
         generateMaze(maze, config.rows, config.cols, rng);
+        openExtraWalls(maze, config.rows, config.cols, config.loopChance, rng);
+        assignTerrain(maze, config.rows, config.cols, config.start, config.end, rng);
         std::cout << "Debug: Maze created.\n";
 
         // Run DFS exploration
@@ -267,6 +456,11 @@ int main() {
         auto shortestPathDict = findShortestPathBFS(maze, config.start, config.end);
         std::cout << "Debug: Shortest path dict segments: " << shortestPathDict.size() << "\n";
 
+        // Run Dijkstra for cheapest path over the floor colours
+        std::cout << "Debug: Finding cheapest path over weighted terrain...\n";
+        auto cheapestPathDict = findCheapestPathDijkstra(maze, config.start, config.end, config.terrainCosts);
+        std::cout << "Debug: Cheapest path dict segments: " << cheapestPathDict.size() << "\n";
+
         // SFML Visualization
         sf::RenderWindow window(sf::VideoMode(config.cols * CELL_SIZE, config.rows * CELL_SIZE), "Maze Visualization");
         window.setFramerateLimit(60);
@@ -277,30 +471,42 @@ int main() {
         agentExplore.setOrigin(AGENT_SIZE / 2, AGENT_SIZE / 2);
 
         sf::RectangleShape agentShortest(sf::Vector2f(AGENT_SIZE, AGENT_SIZE));
-        agentShortest.setFillColor(sf::Color::Red);
+        agentShortest.setFillColor(sf::Color(255, 140, 0)); // Orange
         agentShortest.setOrigin(AGENT_SIZE / 2, AGENT_SIZE / 2);
 
+        sf::RectangleShape agentCheapest(sf::Vector2f(AGENT_SIZE, AGENT_SIZE));
+        agentCheapest.setFillColor(sf::Color::Red);
+        agentCheapest.setOrigin(AGENT_SIZE / 2, AGENT_SIZE / 2);
+
+        // The dicts map each cell to the next one along the route, so walk them forwards from the start
+        auto walkPath = [&](const std::map<std::pair<int, int>, std::pair<int, int>>& pathDict) {
+            std::vector<std::pair<int, int>> path;
+            if (pathDict.empty()) return path;
+            auto curr = config.start;
+            path.push_back(curr);
+            while (pathDict.find(curr) != pathDict.end()) {
+                curr = pathDict.at(curr);
+                path.push_back(curr);
+            }
+            return path;
+        };
+
         // Animation variables
         size_t exploreIdx = 0;
         size_t shortestIdx = 0;
+        size_t cheapestIdx = 0;
         bool showExplore = !explorationSequence.empty();
         bool showShortest = !shortestPathDict.empty();
-        std::vector<std::pair<int, int>> shortestPath;
-        if (showShortest) {
-            auto curr = config.end;
-            shortestPath.push_back(curr);
-            while (shortestPathDict.find(curr) != shortestPathDict.end()) {
-                curr = shortestPathDict[curr];
-                shortestPath.push_back(curr);
-            }
-            std::reverse(shortestPath.begin(), shortestPath.end());
-        }
+        bool showCheapest = !cheapestPathDict.empty();
+        std::vector<std::pair<int, int>> shortestPath = walkPath(shortestPathDict);
+        std::vector<std::pair<int, int>> cheapestPath = walkPath(cheapestPathDict);
 
         sf::Clock clock;
         float exploreDelay = 0.03f; // 30ms per step
-        float shortestDelay = 0.075f; // 75ms per step
+        float routeDelay = 0.075f; // 75ms per step, shared so both route agents move in lockstep
         float exploreTimer = 0.0f;
         float shortestTimer = 0.0f;
+        float cheapestTimer = 0.0f;
 
         while (window.isOpen()) {
             sf::Event event;
@@ -318,6 +524,20 @@ int main() {
                 for (int c = 0; c < config.cols; ++c) {
                     float x = c * CELL_SIZE;
                     float y = r * CELL_SIZE;
+
+                    // Tint coloured floor tiles; black floor is left white so walls stay visible
+                    if (maze[r][c].terrain != BLACK) {
+                        sf::RectangleShape tile(sf::Vector2f(CELL_SIZE - 2, CELL_SIZE - 2));
+                        tile.setPosition(x + 1, y + 1);
+                        switch (maze[r][c].terrain) {
+                            case RED: tile.setFillColor(sf::Color(255, 180, 180)); break;
+                            case GREEN: tile.setFillColor(sf::Color(180, 255, 180)); break;
+                            case YELLOW: tile.setFillColor(sf::Color(255, 255, 170)); break;
+                            default: tile.setFillColor(sf::Color(180, 200, 255)); break;
+                        }
+                        window.draw(tile);
+                    }
+
                     sf::VertexArray lines(sf::Lines, 8);
                     if (maze[r][c].walls[0]) { // East
                         lines[0].position = sf::Vector2f(x + CELL_SIZE, y);
@@ -371,10 +591,10 @@ int main() {
                 }
             }
 
-            // Update and draw shortest path agent
+            // Update and draw shortest (fewest steps) path agent alongside the cheapest one for comparison
             if (!showExplore && showShortest && shortestIdx < shortestPath.size()) {
                 shortestTimer += deltaTime;
-                if (shortestTimer >= shortestDelay) {
+                if (shortestTimer >= routeDelay) {
                     shortestIdx++;
                     shortestTimer = 0.0f;
                 }
@@ -388,10 +608,27 @@ int main() {
                 }
             }
 
+            // Update and draw cheapest path agent
+            if (!showExplore && showCheapest && cheapestIdx < cheapestPath.size()) {
+                cheapestTimer += deltaTime;
+                if (cheapestTimer >= routeDelay) {
+                    cheapestIdx++;
+                    cheapestTimer = 0.0f;
+                }
+                if (cheapestIdx < cheapestPath.size()) {
+                    auto [r, c] = cheapestPath[cheapestIdx];
+                    agentCheapest.setPosition(c * CELL_SIZE + CELL_SIZE / 2, r * CELL_SIZE + CELL_SIZE / 2);
+                    window.draw(agentCheapest);
+                } else {
+                    showCheapest = false;
+                    std::cout << "Debug: Cheapest path visualization finished.\n";
+                }
+            }
+
             window.display();
 
-            // Close window after both animations
-            if (!showExplore && !showShortest) {
+            // Close window after all animations
+            if (!showExplore && !showShortest && !showCheapest) {
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
                 window.close();
             }
@@ -430,4 +667,14 @@ int main() {
  *   number of columns = 10
  *   start_location = (1, 1)
  *   end_location = (10, 10)
+ *
+ * Optional floor tile costs (defaults shown; use -1 to forbid any colour but black):
+ *   black_cost = 1
+ *   red_cost = 10
+ *   green_cost = 2
+ *   yellow_cost = 3
+ *   blue_cost = 5
+ *
+ * Optional fraction of interior walls removed to create loops (default shown; 0 keeps a perfect maze):
+ *   loop_chance = 0.1
  */
@@ -0,0 +1,516 @@
+#include <vector>
+#include <stack>
+#include <string>
+#include <fstream>
+#include <regex>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Constants
+const std::string MAZE_CONFIG_FILE = "maze_config.txt";
+const unsigned int DEFAULT_MAZE_SEED = 1; // Same maze for every gain set unless a seed is given on the command line
+const double PI = 3.14159265358979323846;
+
+// Maze and robot geometry (cm)
+const double CELL_SIZE_CM = 40.0;
+const double ROBOT_RADIUS = 8.0;
+const double WHEEL_BASE = 14.0;
+const double SIDE_SENSOR_OFFSET = 6.0; // Front/rear offset of the two left-facing sensors from the centre
+// Sideways offset that puts the left sensors on the rim of the body, so they can never poke through a wall
+const double SIDE_SENSOR_INSET = std::sqrt(ROBOT_RADIUS * ROBOT_RADIUS - SIDE_SENSOR_OFFSET * SIDE_SENSOR_OFFSET);
+const double MAX_WHEEL_SPEED = 60.0; // cm/s at full PWM (255)
+const double BEAM_HALF_ANGLE = 7.5 * PI / 180; // HC-SR04 measuring cone is about 15 degrees
+
+// Control law constants, copied from Arduino/pid-wall.ino
+const double DIST_PROPORTIONAL_CONST = 0.034 / 2;
+const double INPUT_DISTANCE = 15;
+const double ERROR_DIST = 5;
+const int SPEED = 95;
+const double MAX_SENSOR_VALUE = 10000;
+const double MAX_OF_SENSOR = 3000;
+const int MAX_DIFFERNCE = 10;
+const int MAX_TURN_SPEED = 10;
+const int CALIBRATION = 3;
+const double MAX_ALLIGN_ANGLE = 5;
+const double COLLISION_DISTANCE = 10;
+const double CONTROL_DT = 0.1; // dt in the sketch: one control update per 100 ms
+
+// Turning decisions, as in WALL_FOLLOWER() in Arduino/PID-wallollowerV1.ino
+const double LEFT_OPENING_DISTANCE = 30; // Front-left sensor beyond this means the left wall has ended
+const int WF_SPEED = SPEED;
+const int WF_NO_SPEED = 0;
+// Seconds driven straight once the front-left sensor passes a wall end, so the pivot lands mid-opening
+const double LEFT_TURN_DELAY = (CELL_SIZE_CM / 2 + SIDE_SENSOR_OFFSET) / (SPEED / 255.0 * MAX_WHEEL_SPEED);
+// Pivots run as blocking quarter turns about the stopped wheel
+const double QUARTER_TURN_TIME = (PI / 2) * WHEEL_BASE / (WF_SPEED / 255.0 * MAX_WHEEL_SPEED);
+
+// Simulation settings
+const double PHYSICS_DT = 0.02; // Integration step, several per control update
+const double MAX_LAP_TIME = 1200.0; // Simulated seconds before a lap counts as unfinished
+const double STUCK_TIME = 10.0; // Seconds between progress checks
+const double STUCK_DISTANCE = ROBOT_RADIUS; // Moving less than this between checks counts as stuck
+const double CONTACT_PENALTY = 5.0; // Seconds added to the lap time per wall contact when ranking
+const size_t RESULTS_TO_SHOW = 20;
+
+// Gain values swept for each tuning parameter
+const std::vector<double> KP_A_VALUES = {0, 0.25, 0.5, 1, 2, 4};
+const std::vector<double> KD_A_VALUES = {0, 0.5, 1, 2, 4};
+const std::vector<double> KP_D_VALUES = {0, 0.25, 0.5, 1, 2, 4};
+const std::vector<double> KI_D_VALUES = {0, 0.01, 0.05, 0.1};
+const std::vector<double> KD_D_VALUES = {0, 0.5, 1, 2, 4};
+
+// Configuration struct
+struct Config {
+    int rows, cols;
+    std::pair<int, int> start, end;
+};
+
+// Maze cell structure
+struct Cell {
+    bool walls[4] = {true, true, true, true}; // E, S, W, N
+    bool visited = false;
+};
+
+// Offsets in E, S, W, N order, matching Cell::walls
+const int ROW_STEP[4] = {0, 1, 0, -1};
+const int COL_STEP[4] = {1, 0, -1, 0};
+
+// Gains tuned on the robot: angle PD and distance PID
+struct Gains {
+    double kp_a, kd_a, kp_d, ki_d, kd_d;
+};
+
+// Outcome of one simulated run
+struct LapResult {
+    Gains gains;
+    bool finished = false;
+    double lapTime = MAX_LAP_TIME;
+    double drivingTime = MAX_LAP_TIME; // Simulated time before the lap finished or the robot got stuck
+    int wallContacts = 0;
+
+    double score() const { return lapTime + CONTACT_PENALTY * wallContacts; }
+};
+
+// Parse coordinate from config string
+std::pair<int, int> parseCoordinate(const std::string& content, const std::string& key) {
+    std::regex pattern(key + "\\s*=\\s*\\((\\d+)\\s*,\\s*(\\d+)\\)");
+    std::smatch match;
+    if (!std::regex_search(content, match, pattern)) {
+        throw std::runtime_error("Cannot parse '" + key + "'. Expected format: " + key + " = (row, col)");
+    }
+    return {std::stoi(match[1]), std::stoi(match[2])};
+}
+
+// Read configuration file
+Config extractVariables(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Configuration file '" + filename + "' not found.");
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    std::regex rowsRegex("number of rows\\s*=\\s*(\\d+)");
+    std::regex colsRegex("number of columns\\s*=\\s*(\\d+)");
+    std::smatch match;
+
+    Config config;
+    if (std::regex_search(content, match, rowsRegex)) {
+        config.rows = std::stoi(match[1]);
+        if (config.rows < 1) throw std::runtime_error("Rows must be positive.");
+    } else {
+        throw std::runtime_error("Missing 'number of rows' in config.");
+    }
+
+    if (std::regex_search(content, match, colsRegex)) {
+        config.cols = std::stoi(match[1]);
+        if (config.cols < 1) throw std::runtime_error("Columns must be positive.");
+    } else {
+        throw std::runtime_error("Missing 'number of columns' in config.");
+    }
+
+    config.start = parseCoordinate(content, "start_location");
+    config.end = parseCoordinate(content, "end_location");
+
+    auto validateCoord = [&](const std::pair<int, int>& coord, const std::string& name) {
+        if (coord.first < 1 || coord.first > config.rows || coord.second < 1 || coord.second > config.cols) {
+            throw std::runtime_error(name + " (" + std::to_string(coord.first) + "," + std::to_string(coord.second) +
+                                     ") is outside maze boundaries (1..." + std::to_string(config.rows) + ", 1..." +
+                                     std::to_string(config.cols) + ").");
+        }
+    };
+    validateCoord(config.start, "Start location");
+    validateCoord(config.end, "End location");
+
+    // Convert to 0-based indexing
+    config.start = {config.start.first - 1, config.start.second - 1};
+    config.end = {config.end.first - 1, config.end.second - 1};
+    return config;
+}
+
+// Generate maze using recursive backtracking
+void generateMaze(std::vector<std::vector<Cell>>& maze, int rows, int cols, std::mt19937& rng) {
+    std::stack<std::pair<int, int>> stack;
+    maze[0][0].visited = true;
+    stack.push({0, 0});
+
+    while (!stack.empty()) {
+        auto [r, c] = stack.top();
+        stack.pop();
+
+        // Get unvisited neighbors as (position, wall index)
+        std::vector<std::pair<std::pair<int, int>, int>> neighbors;
+        for (int dir = 0; dir < 4; ++dir) {
+            int nr = r + ROW_STEP[dir], nc = c + COL_STEP[dir];
+            if (nr >= 0 && nr < rows && nc >= 0 && nc < cols && !maze[nr][nc].visited) {
+                neighbors.push_back({{nr, nc}, dir});
+            }
+        }
+
+        if (!neighbors.empty()) {
+            stack.push({r, c});
+            std::shuffle(neighbors.begin(), neighbors.end(), rng);
+            auto [pos, dir] = neighbors[0];
+            auto [nr, nc] = pos;
+
+            // Remove walls between current and neighbor
+            maze[r][c].walls[dir] = false;
+            maze[nr][nc].walls[(dir + 2) % 4] = false;
+
+            maze[nr][nc].visited = true;
+            stack.push({nr, nc});
+        }
+    }
+}
+
+// Distance along a ray to the first wall, walking the grid one cell boundary at a time
+double castRay(const std::vector<std::vector<Cell>>& maze, double x, double y, double heading) {
+    const int rows = maze.size();
+    const int cols = maze[0].size();
+    double dx = std::cos(heading), dy = std::sin(heading);
+    int r = static_cast<int>(y / CELL_SIZE_CM), c = static_cast<int>(x / CELL_SIZE_CM);
+    r = std::clamp(r, 0, rows - 1);
+    c = std::clamp(c, 0, cols - 1);
+
+    // Ray parameter at which the next vertical / horizontal cell boundary is crossed
+    const double INF = std::numeric_limits<double>::infinity();
+    double stepX = dx > 0 ? CELL_SIZE_CM / dx : dx < 0 ? -CELL_SIZE_CM / dx : INF;
+    double stepY = dy > 0 ? CELL_SIZE_CM / dy : dy < 0 ? -CELL_SIZE_CM / dy : INF;
+    double nextX = dx > 0 ? ((c + 1) * CELL_SIZE_CM - x) / dx : dx < 0 ? (c * CELL_SIZE_CM - x) / dx : INF;
+    double nextY = dy > 0 ? ((r + 1) * CELL_SIZE_CM - y) / dy : dy < 0 ? (r * CELL_SIZE_CM - y) / dy : INF;
+
+    while (true) {
+        if (nextX < nextY) {
+            int wall = dx > 0 ? 0 : 2; // East or West
+            if (maze[r][c].walls[wall]) return nextX;
+            c += COL_STEP[wall];
+            nextX += stepX;
+        } else {
+            int wall = dy > 0 ? 1 : 3; // South or North
+            if (maze[r][c].walls[wall]) return nextY;
+            r += ROW_STEP[wall];
+            nextY += stepY;
+        }
+    }
+}
+
+// Ultrasonic reading as sensor_output() in pid-wall.ino reports it: a zero duration or an echo past the timeout
+// both read as MAX_OF_SENSOR
+double sensorOutput(const std::vector<std::vector<Cell>>& maze, double x, double y, double heading) {
+    // The nearest echo across the cone wins, so thin gaps at wall ends don't read as open space
+    double range = std::min({castRay(maze, x, y, heading), castRay(maze, x, y, heading - BEAM_HALF_ANGLE),
+                             castRay(maze, x, y, heading + BEAM_HALF_ANGLE)});
+    // A sensor pressed against a wall can end up just behind it; clamp so that reads as zero duration, which the
+    // sketch (like pulseIn() returning 0 on a missed echo) treats as open space
+    range = std::max(range, 0.0);
+    double duration = range / DIST_PROPORTIONAL_CONST;
+    if (duration == 0.0 || duration >= MAX_SENSOR_VALUE) {
+        duration = MAX_OF_SENSOR;
+    }
+    return duration * DIST_PROPORTIONAL_CONST;
+}
+
+// Push a robot centred at (x, y) out of any wall of its cell or the four neighbouring cells.
+// Moving along the contact normal lets it slide along walls and round wall ends. Returns true on contact.
+bool pushOutOfWalls(const std::vector<std::vector<Cell>>& maze, double& x, double& y) {
+    const int rows = maze.size();
+    const int cols = maze[0].size();
+    bool touched = false;
+
+    auto pushFromSegment = [&](double x1, double y1, double x2, double y2) {
+        // Segments are axis aligned, so clamp the centre onto the segment
+        double px = std::clamp(x, std::min(x1, x2), std::max(x1, x2));
+        double py = std::clamp(y, std::min(y1, y2), std::max(y1, y2));
+        double dist = std::hypot(x - px, y - py);
+        if (dist >= ROBOT_RADIUS || dist == 0) return;
+        x = px + (x - px) / dist * ROBOT_RADIUS;
+        y = py + (y - py) / dist * ROBOT_RADIUS;
+        touched = true;
+    };
+    auto pushFromCell = [&](int cr, int cc) {
+        if (cr < 0 || cr >= rows || cc < 0 || cc >= cols) return;
+        double left = cc * CELL_SIZE_CM, top = cr * CELL_SIZE_CM;
+        double right = left + CELL_SIZE_CM, bottom = top + CELL_SIZE_CM;
+        const Cell& cell = maze[cr][cc];
+        if (cell.walls[0]) pushFromSegment(right, top, right, bottom);
+        if (cell.walls[1]) pushFromSegment(left, bottom, right, bottom);
+        if (cell.walls[2]) pushFromSegment(left, top, left, bottom);
+        if (cell.walls[3]) pushFromSegment(left, top, right, top);
+    };
+
+    // A second pass settles corners, where pushing off one wall can press into the other
+    for (int pass = 0; pass < 2; ++pass) {
+        int r = std::clamp(static_cast<int>(std::floor(y / CELL_SIZE_CM)), 0, rows - 1);
+        int c = std::clamp(static_cast<int>(std::floor(x / CELL_SIZE_CM)), 0, cols - 1);
+        pushFromCell(r, c);
+        for (int i = 0; i < 4; ++i) pushFromCell(r + ROW_STEP[i], c + COL_STEP[i]);
+    }
+    return touched;
+}
+
+// Run one lap of the left-wall follower from pid-wall.ino with the given gains
+LapResult simulateLap(const std::vector<std::vector<Cell>>& maze, const Config& config, const Gains& gains) {
+    LapResult result;
+    result.gains = gains;
+
+    // Start in the centre of the start cell, facing the first open direction
+    double x = (config.start.second + 0.5) * CELL_SIZE_CM;
+    double y = (config.start.first + 0.5) * CELL_SIZE_CM;
+    double heading = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        if (!maze[config.start.first][config.start.second].walls[i]) {
+            heading = std::atan2(ROW_STEP[i], COL_STEP[i]);
+            break;
+        }
+    }
+
+    // Controller state, reset per lap as on power-up
+    double previousErrorD = 0, integral = 0, previousAngle = 0;
+    int speedL = SPEED, speedR = SPEED;
+    bool inContact = false;
+    double turnTimeLeft = 0;
+    double leftOpenTime = 0;
+    double checkpointX = x, checkpointY = y, checkpointTime = 0;
+    const int substeps = static_cast<int>(std::round(CONTROL_DT / PHYSICS_DT));
+
+    for (double t = 0; t < MAX_LAP_TIME; t += CONTROL_DT) {
+        if (static_cast<int>(y / CELL_SIZE_CM) == config.end.first &&
+            static_cast<int>(x / CELL_SIZE_CM) == config.end.second) {
+            result.finished = true;
+            result.lapTime = t;
+            result.drivingTime = t;
+            return result;
+        }
+
+        // Sensors: 1 is rear-left, 2 is front-left, 3 faces forward (heading grows clockwise, y points south).
+        // They sit on the edge of the body, so readings are measured from there rather than the centre
+        double left = heading - PI / 2;
+        double sideX = x + SIDE_SENSOR_INSET * std::cos(left), sideY = y + SIDE_SENSOR_INSET * std::sin(left);
+        double distance1 = sensorOutput(maze, sideX - SIDE_SENSOR_OFFSET * std::cos(heading),
+                                        sideY - SIDE_SENSOR_OFFSET * std::sin(heading), left);
+        double distance2 = sensorOutput(maze, sideX + SIDE_SENSOR_OFFSET * std::cos(heading),
+                                        sideY + SIDE_SENSOR_OFFSET * std::sin(heading), left);
+        double distance3 = sensorOutput(maze, x + ROBOT_RADIUS * std::cos(heading),
+                                        y + ROBOT_RADIUS * std::sin(heading), heading);
+
+        // Pivot turns from PID-wallollowerV1.ino, PID steering from loop() in pid-wall.ino
+        double currentDistance = (distance1 + distance2) / 2;
+        double allignAngle = std::abs(distance2 - distance1);
+        bool inRegion = std::abs(currentDistance - INPUT_DISTANCE) <= ERROR_DIST;
+        bool leftOpen = distance2 > LEFT_OPENING_DISTANCE;
+
+        if (turnTimeLeft > 0) {
+            // Still inside a pivot, keep the wheel speeds
+            turnTimeLeft -= CONTROL_DT;
+        } else if (leftOpen && (leftOpenTime >= LEFT_TURN_DELAY || distance3 < COLLISION_DISTANCE)) {
+            // WF_LEFT(), which takes priority over the front wall as in the left-hand rule
+            speedL = WF_NO_SPEED;
+            speedR = WF_SPEED;
+            turnTimeLeft = QUARTER_TURN_TIME - CONTROL_DT;
+            leftOpenTime = 0;
+        } else if (distance3 < COLLISION_DISTANCE) {
+            // WF_RIGHT()
+            speedL = WF_SPEED;
+            speedR = WF_NO_SPEED;
+            turnTimeLeft = QUARTER_TURN_TIME - CONTROL_DT;
+        } else if (leftOpen) {
+            // Drive on past the wall end before turning into the opening
+            speedL = SPEED;
+            speedR = SPEED;
+            leftOpenTime += CONTROL_DT;
+        } else if (inRegion || allignAngle > MAX_ALLIGN_ANGLE) {
+            // follow_wall(), including the sketch's repeated '>' in its second clamp
+            leftOpenTime = 0;
+            double angle = distance2 - distance1;
+            double derivativeA = angle - previousAngle;
+            double outputA = gains.kp_a * angle + gains.kd_a * derivativeA;
+            previousAngle = angle;
+            speedL = static_cast<int>(SPEED + CALIBRATION - outputA);
+            speedR = static_cast<int>(SPEED + outputA);
+            if ((speedL - speedR) > MAX_TURN_SPEED) {
+                speedL = SPEED + CALIBRATION + MAX_TURN_SPEED;
+                speedR = SPEED - MAX_TURN_SPEED;
+            }
+        } else {
+            // reach_distance()
+            leftOpenTime = 0;
+            double errorD = currentDistance - INPUT_DISTANCE;
+            double derivative = errorD - previousErrorD;
+            integral += errorD;
+            double outputD = gains.kp_d * errorD + gains.ki_d * integral * CONTROL_DT + gains.kd_d * derivative;
+            previousErrorD = errorD;
+            speedL = SPEED - static_cast<int>(outputD);
+            speedR = SPEED + static_cast<int>(outputD);
+            if ((speedL - speedR) > MAX_DIFFERNCE) {
+                speedL = SPEED + MAX_DIFFERNCE;
+                speedR = SPEED - MAX_DIFFERNCE;
+            } else if ((speedL - speedR) < -MAX_DIFFERNCE) {
+                speedL = SPEED - MAX_DIFFERNCE;
+                speedR = SPEED + MAX_DIFFERNCE;
+            }
+        }
+        // analogWrite() only takes 0..255 and the motors are always driven forward
+        speedL = std::clamp(speedL, 0, 255);
+        speedR = std::clamp(speedR, 0, 255);
+
+        // Differential-drive kinematics between control updates
+        double vL = speedL / 255.0 * MAX_WHEEL_SPEED;
+        double vR = speedR / 255.0 * MAX_WHEEL_SPEED;
+        for (int s = 0; s < substeps; ++s) {
+            heading -= (vR - vL) / WHEEL_BASE * PHYSICS_DT;
+            double v = (vL + vR) / 2;
+            x += v * std::cos(heading) * PHYSICS_DT;
+            y += v * std::sin(heading) * PHYSICS_DT;
+
+            // On contact the robot scrapes along the wall instead of passing through it; count each new contact once
+            bool touched = pushOutOfWalls(maze, x, y);
+            if (touched && !inContact) result.wallContacts++;
+            inContact = touched;
+        }
+
+        // A robot that has not left the neighbourhood of its last checkpoint is wedged; end the lap there
+        if (t + CONTROL_DT >= checkpointTime + STUCK_TIME) {
+            if (std::hypot(x - checkpointX, y - checkpointY) < STUCK_DISTANCE) {
+                result.drivingTime = checkpointTime;
+                return result;
+            }
+            checkpointX = x;
+            checkpointY = y;
+            checkpointTime = t + CONTROL_DT;
+        }
+    }
+    return result;
+}
+
+// Build every combination of the swept gain values
+std::vector<Gains> buildGainGrid() {
+    std::vector<Gains> grid;
+    for (double kp_a : KP_A_VALUES)
+        for (double kd_a : KD_A_VALUES)
+            for (double kp_d : KP_D_VALUES)
+                for (double ki_d : KI_D_VALUES)
+                    for (double kd_d : KD_D_VALUES)
+                        grid.push_back({kp_a, kd_a, kp_d, ki_d, kd_d});
+    return grid;
+}
+
+// Simulate every gain set, spreading runs over all hardware threads
+std::vector<LapResult> sweepGains(const std::vector<std::vector<Cell>>& maze, const Config& config,
+                                  const std::vector<Gains>& grid) {
+    std::vector<LapResult> results(grid.size());
+    std::atomic<size_t> nextRun{0};
+    unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "Debug: Sweeping " << grid.size() << " gain sets on " << threadCount << " threads...\n";
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        workers.emplace_back([&]() {
+            // Each worker writes only its own slots, so no locking is needed
+            for (size_t run = nextRun++; run < grid.size(); run = nextRun++) {
+                results[run] = simulateLap(maze, config, grid[run]);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    return results;
+}
+
+// Main function
+int main(int argc, char* argv[]) {
+    try {
+        std::cout << "Debug: Loading configuration...\n";
+        Config config = extractVariables(MAZE_CONFIG_FILE);
+        std::cout << "Debug: Config loaded - Rows: " << config.rows << ", Cols: " << config.cols
+                  << ", Start: (" << config.start.first + 1 << "," << config.start.second + 1
+                  << "), End: (" << config.end.first + 1 << "," << config.end.second + 1 << ")\n";
+
+        unsigned int seed = argc > 1 ? static_cast<unsigned int>(std::stoul(argv[1])) : DEFAULT_MAZE_SEED;
+        std::vector<std::vector<Cell>> maze(config.rows, std::vector<Cell>(config.cols));
+        std::mt19937 rng(seed);
+        std::cout << "Debug: Generating maze with seed " << seed << "...\n";
+        generateMaze(maze, config.rows, config.cols, rng);
+
+        auto grid = buildGainGrid();
+        auto sweepStart = std::chrono::steady_clock::now();
+        auto results = sweepGains(maze, config, grid);
+        double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - sweepStart).count();
+
+        double simulatedSeconds = 0;
+        size_t finishedCount = 0;
+        for (const auto& result : results) {
+            simulatedSeconds += result.drivingTime;
+            if (result.finished) finishedCount++;
+        }
+        std::cout << "Debug: Simulated " << simulatedSeconds << " s of driving in " << wallSeconds << " s ("
+                  << simulatedSeconds / wallSeconds << "x real time). " << finishedCount << " of "
+                  << results.size() << " gain sets finished.\n";
+
+        // Finished laps first, then by lap time with a penalty per wall contact
+        std::sort(results.begin(), results.end(), [](const LapResult& a, const LapResult& b) {
+            if (a.finished != b.finished) return a.finished;
+            if (a.score() != b.score()) return a.score() < b.score();
+            return a.wallContacts < b.wallContacts;
+        });
+
+        std::cout << "\n--- Best " << std::min(RESULTS_TO_SHOW, results.size()) << " gain sets ---\n";
+        std::cout << std::setw(6) << "kp_a" << std::setw(6) << "kd_a" << std::setw(6) << "kp_d" << std::setw(6)
+                  << "ki_d" << std::setw(6) << "kd_d" << std::setw(10) << "lap (s)" << std::setw(10) << "contacts"
+                  << "\n";
+        for (size_t i = 0; i < std::min(RESULTS_TO_SHOW, results.size()); ++i) {
+            const auto& result = results[i];
+            std::cout << std::setw(6) << result.gains.kp_a << std::setw(6) << result.gains.kd_a << std::setw(6)
+                      << result.gains.kp_d << std::setw(6) << result.gains.ki_d << std::setw(6)
+                      << result.gains.kd_d << std::setw(10) << std::fixed << std::setprecision(1)
+                      << result.lapTime << std::setw(10) << result.wallContacts
+                      << (result.finished ? "" : "  (did not finish)") << "\n"
+                      << std::defaultfloat << std::setprecision(6);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Headless simulator for tuning the gains in Arduino/pid-wall.ino. It generates a maze from
+ * maze_config.txt, drives a differential-drive robot with two left-facing and one forward-facing
+ * ultrasonic sensor through it using the sketch's PID steering (with the pivot turns from
+ * PID-wallollowerV1.ino at walls and openings), and ranks every gain combination in the
+ * KP_A_VALUES ... KD_D_VALUES lists by lap time and wall contacts.
+ *
+ * To compile and run (no SFML needed):
+ *   g++ -std=c++17 -O2 -pthread "PID wall follower sim.cpp" -o pid_sim
+ *   ./pid_sim [maze seed]
+ *
+ * On Windows (MSVC), build with /std:c++17 /O2.
+ *
+ * Ensure maze_config.txt is in the same directory (see DFS FOR C++ (1).cpp for the format).
+ */